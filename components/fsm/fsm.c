@@ -53,6 +53,7 @@ static QueueHandle_t qInput = NULL;      ///< Input event queue
 static QueueHandle_t qOutput = NULL;     ///< Output command queue
 static fsm_state_t fsm_state = MODE_OFF; ///< Current FSM state
 static uint64_t last_event_timestamp_ms = 0; ///< Last event timestamp
+static uint32_t last_touch_hold_ms = 0;  ///< Timestamp of the last touch hold event, to drop repeats
 
 /**
  * @brief Get current time in milliseconds
@@ -352,6 +353,28 @@ static bool process_touch_event(const touch_event_t *touch_evt, uint32_t timesta
         return true;
     }
 
+    // A hold starts a sunrise when off, or a sunset when on. Only the first
+    // event of a hold counts; the repeats sent while the pad stays held are dropped
+    if (touch_evt->type == TOUCH_HOLD) {
+        bool is_repeat = timestamp - last_touch_hold_ms < 2 * TOUCH_HOLD_REPEAT_TIME_MS;
+        last_touch_hold_ms = timestamp;
+        if (is_repeat) {
+            return false;
+        }
+
+        if (fsm_state == MODE_OFF) {
+            fsm_state = MODE_DISPLAY;
+            send_led_command(LED_CMD_START_SUNRISE, timestamp, SUNRISE_DURATION_MIN, 0);
+            ESP_LOGI(TAG, "MODE_OFF -> MODE_DISPLAY (Sunrise, Touch Hold)");
+            return true;
+        }
+        if (fsm_state == MODE_DISPLAY) {
+            send_led_command(LED_CMD_START_SUNSET, timestamp, SUNSET_DURATION_MIN, 0);
+            ESP_LOGI(TAG, "Touch hold started sunset");
+            return true;
+        }
+    }
+
     return false;
 }
 
@@ -56,7 +56,11 @@ typedef enum {
     LED_CMD_FEEDBACK_EFFECT_COLOR, ///< Play a blink with the effect's base color
     LED_CMD_FEEDBACK_LIMIT,        ///< Play a blink indicating a parameter limit was hit
 
-    LED_CMD_BUTTON_ERROR           ///< Cancel current configuration
+    LED_CMD_BUTTON_ERROR,          ///< Cancel current configuration
+
+    // --- Appended to keep the values sent over ESP-NOW stable ---
+    LED_CMD_START_SUNRISE,         ///< Turn on and ramp up brightness and white temperature (value = minutes)
+    LED_CMD_START_SUNSET,          ///< Ramp down to minimum brightness and warmest white (value = minutes)
 } led_cmd_type_t;
 
 /**
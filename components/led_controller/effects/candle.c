@@ -55,23 +55,45 @@ void run_candle(const effect_param_t *params, uint8_t num_params,
     if (leds_per_segment == 0)
         leds_per_segment = 1;
 
+    // Base indices into the candle flicker table, reduced once per frame.
+    // The 64-bit divide/modulo is a software routine on Xtensa, so it is
+    // kept out of the segment loop; everything below stays in 32-bit
+    // range (< 2 * CANDLE_TABLE_SIZE) and wraps with a conditional subtract
+    uint32_t base_table_index = (time_ms * speed / 10) % CANDLE_TABLE_SIZE;
+    uint32_t base_variation_index = (time_ms * variation_speed) % CANDLE_TABLE_SIZE;
+
+    // Use segment index as a random-like offset. A prime number helps
+    // decorrelate segments for more natural appearance. Accumulated as
+    // seg * 877 reduced modulo the table size
+    uint32_t time_offset = 0;
+
     // Process each segment independently with unique variations
     for (uint16_t seg = 0; seg < num_segments; seg++) {
-        // Use segment index as a random-like offset. A prime number helps
-        // decorrelate segments for more natural appearance
-        uint32_t time_offset = seg * 877;
-        
         // Calculate indices into the candle flicker table for this segment
-        uint32_t table_index = ((time_ms * speed / 10) + time_offset) % CANDLE_TABLE_SIZE;
-        uint32_t variation_index = ((time_ms * variation_speed) + time_offset) % CANDLE_TABLE_SIZE;
+        uint32_t table_index = base_table_index + time_offset;
+        if (table_index >= CANDLE_TABLE_SIZE)
+            table_index -= CANDLE_TABLE_SIZE;
+
+        uint32_t variation_index = base_variation_index + time_offset;
+        if (variation_index >= CANDLE_TABLE_SIZE)
+            variation_index -= CANDLE_TABLE_SIZE;
+
+        uint32_t sat_variation_index = variation_index + 67;
+        if (sat_variation_index >= CANDLE_TABLE_SIZE)
+            sat_variation_index -= CANDLE_TABLE_SIZE;
+
+        // Advance the offset for the next segment (877 < CANDLE_TABLE_SIZE)
+        time_offset += 877;
+        if (time_offset >= CANDLE_TABLE_SIZE)
+            time_offset -= CANDLE_TABLE_SIZE;
 
         // Get brightness value from precomputed candle flicker table
         uint8_t v_from_table = CANDLE_TABLE[table_index];
 
         // Calculate hue and saturation variations based on noise table
         // to maintain temporal consistency while introducing randomness
-        int16_t hue_variation = ((int16_t)CANDLE_TABLE[variation_index % CANDLE_TABLE_SIZE] - 128) * max_hue_variation / 128;
-        int16_t sat_variation = ((int16_t)CANDLE_TABLE[(variation_index + 67) % CANDLE_TABLE_SIZE] - 128) * max_sat_variation / 128;
+        int16_t hue_variation = ((int16_t)CANDLE_TABLE[variation_index] - 128) * max_hue_variation / 128;
+        int16_t sat_variation = ((int16_t)CANDLE_TABLE[sat_variation_index] - 128) * max_sat_variation / 128;
 
         // Apply variations with bounds checking
         uint16_t varied_hue = (hue + hue_variation) % 360;
@@ -18,7 +18,7 @@
  * @brief White temperature effect parameter configuration
  * 
  * @note Single parameter for selecting white color temperature from
- *       warm (0) to cool (5) with predefined RGB values
+ *       warm (0) to cool (9) with predefined RGB values
  */
 static effect_param_t params_white_temp[] = {
     {.name = "Temperature",
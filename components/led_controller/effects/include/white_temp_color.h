@@ -0,0 +1,28 @@
+/**
+ * @file white_temp_color.h
+ * @brief White temperature color lookup shared with the LED controller
+ * 
+ * @details Declares the fractional white temperature lookup used by the
+ *          white temperature effect and by the controller's temperature
+ *          ramps. Kept apart from white_temp.h, which defines the effect's
+ *          parameter array
+ * 
+ * @author Your Name
+ * @date 2024-03-15
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "led_effects.h" // For rgb_t
+
+/**
+ * @brief Get the RGB color for a fractional white temperature
+ *
+ * @param[in] temp_q16 Temperature index in 16.16 fixed point (0-9)
+ * @return Color linearly interpolated between the two nearest table entries
+ *
+ * @note Used by the LED controller for smooth color temperature ramps.
+ *       Values outside the table are clamped to its ends
+ */
+rgb_t white_temp_rgb(int32_t temp_q16);
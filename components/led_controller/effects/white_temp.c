@@ -13,10 +13,58 @@
 
 // Project specific headers
 #include "led_effects.h" // For color_t, effect_param_t, etc.
+#include "white_temp_color.h"
 
 // Standard library includes
 #include <stdint.h>
 
+/// @brief Number of entries in the white temperature table
+#define WHITE_TEMP_COUNT 10
+
+/// @brief Index used when the temperature parameter is out of range
+#define WHITE_TEMP_NEUTRAL 4
+
+/**
+ * @brief Predefined RGB values for white temperatures from warm to cool
+ */
+static const rgb_t white_temp_table[WHITE_TEMP_COUNT] = {
+    {255, 120, 0},   // 0: Deepest warm white (candlelight)
+    {255, 130, 30},  // 1: Very warm white
+    {255, 140, 50},  // 2: Warm white
+    {255, 160, 80},  // 3: Warm-neutral white
+    {255, 197, 143}, // 4: Neutral white
+    {255, 214, 170}, // 5: Cool-neutral white
+    {255, 240, 220}, // 6: Cool white
+    {255, 255, 255}, // 7: Pure white
+    {201, 226, 255}, // 8: Ice cold white
+    {180, 210, 255}, // 9: Deep cool white (bluish)
+};
+
+/**
+ * @brief Get the RGB color for a fractional white temperature
+ */
+rgb_t white_temp_rgb(int32_t temp_q16) {
+    if (temp_q16 <= 0) {
+        return white_temp_table[0];
+    }
+
+    uint32_t index = (uint32_t)temp_q16 >> 16;
+    if (index >= WHITE_TEMP_COUNT - 1) {
+        return white_temp_table[WHITE_TEMP_COUNT - 1];
+    }
+
+    // Interpolate with 8 fractional bits, plenty for 8-bit channels
+    int32_t frac = (temp_q16 >> 8) & 0xFF;
+    rgb_t a = white_temp_table[index];
+    rgb_t b = white_temp_table[index + 1];
+    rgb_t out = {
+        .r = (uint8_t)(a.r + (((int32_t)b.r - a.r) * frac) / 256),
+        .g = (uint8_t)(a.g + (((int32_t)b.g - a.g) * frac) / 256),
+        .b = (uint8_t)(a.b + (((int32_t)b.b - a.b) * frac) / 256),
+    };
+    return out;
+}
+
 /**
  * @brief Runs the white temperature effect algorithm
  * 
@@ -30,7 +78,7 @@
  * @note Uses predefined RGB values for different white temperature levels
  *       ranging from warm (reddish) to cool (bluish) white
  * 
- * @warning Temperature index must be between 0-5, defaults to neutral if out of range
+ * @warning Temperature index must be between 0-9, defaults to neutral if out of range
  * @note Brightness is controlled externally by the LED controller
  */
 void run_white_temp(const effect_param_t *params, uint8_t num_params,
@@ -39,48 +87,15 @@ void run_white_temp(const effect_param_t *params, uint8_t num_params,
 
     // Get temperature index from parameters
     int16_t temp_index = params[0].value;
-    rgb_t rgb;
 
-    // Select RGB values based on temperature index
-    // Predefined values represent different white color temperatures from warm to cool
-    switch (temp_index) {
-    case 0: // Deepest warm white (candlelight)
-        rgb = (rgb_t){255, 120, 0};
-        break;
-    case 1: // Very warm white
-        rgb = (rgb_t){255, 130, 30};
-        break;
-    case 2: // Warm white
-        rgb = (rgb_t){255, 140, 50};
-        break;
-    case 3: // Warm-neutral white
-        rgb = (rgb_t){255, 160, 80};
-        break;
-    case 4: // Neutral white
-        rgb = (rgb_t){255, 197, 143};
-        break;
-    case 5: // Cool-neutral white
-        rgb = (rgb_t){255, 214, 170};
-        break;
-    case 6: // Cool white
-        rgb = (rgb_t){255, 240, 220};
-        break;
-    case 7: // Pure white
-        rgb = (rgb_t){255, 255, 255};
-        break;
-    case 8: // Ice cold white
-        rgb = (rgb_t){201, 226, 255};
-        break;
-    case 9: // Deep cool white (bluish)
-        rgb = (rgb_t){180, 210, 255};
-        break;
-    default: // Fallback to neutral white if index is out of range
-        rgb = (rgb_t){255, 197, 143};
-        break;
+    // Fallback to neutral white if index is out of range
+    if (temp_index < 0 || temp_index >= WHITE_TEMP_COUNT) {
+        temp_index = WHITE_TEMP_NEUTRAL;
     }
+    rgb_t rgb = white_temp_table[temp_index];
 
     // Apply the selected white temperature to all pixels
     for (uint16_t i = 0; i < num_pixels; i++) {
         pixels[i].rgb = rgb;
     }
-}
\ No newline at end of file
+}
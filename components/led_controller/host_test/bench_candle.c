@@ -0,0 +1,54 @@
+/**
+ * @file bench_candle.c
+ * @brief Host benchmark: run_candle() against the reference implementation
+ *
+ * @note The host has hardware 64-bit division, so the gap here understates
+ *       the gain on Xtensa, where it is a software routine
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "candle.h"
+#include "candle_reference.h"
+
+/// @brief Number of frames rendered per implementation
+#define BENCH_FRAMES 200000
+
+/// @brief Pixel count of the default strip
+#define BENCH_PIXELS 48
+
+/**
+ * @brief Time one implementation over BENCH_FRAMES frames of 10ms
+ */
+static double bench(effect_run_t run, effect_param_t *params, uint32_t *checksum) {
+    color_t pixels[BENCH_PIXELS];
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++) {
+        run(params, 4, 255, (uint64_t)i * 10, pixels, BENCH_PIXELS);
+        *checksum += pixels[i % BENCH_PIXELS].hsv.v;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    return ns / BENCH_FRAMES;
+}
+
+int main(void) {
+    effect_param_t params[4];
+    memcpy(params, params_candle, sizeof(params));
+    params[0].value = 10; // Speed
+    params[3].value = 20; // Segments
+
+    uint32_t checksum_ref = 0, checksum_new = 0;
+    double ref_ns = bench(run_candle_reference, params, &checksum_ref);
+    double new_ns = bench(run_candle, params, &checksum_new);
+
+    printf("reference: %8.1f ns/frame\n", ref_ns);
+    printf("current:   %8.1f ns/frame\n", new_ns);
+    printf("checksums %s\n", checksum_ref == checksum_new ? "match" : "DIFFER");
+    return checksum_ref == checksum_new ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file candle_reference.h
+ * @brief Reference candle effect used by the host tests
+ */
+
+#pragma once
+
+#include "led_effects.h" // For effect_param_t, color_t
+
+/**
+ * @brief Original run_candle() implementation, see candle_reference.c
+ */
+void run_candle_reference(const effect_param_t *params, uint8_t num_params,
+                          uint8_t brightness, uint64_t time_ms,
+                          color_t *pixels, uint16_t num_pixels);
@@ -0,0 +1,6 @@
+/**
+ * @file esp_debug_helpers.h
+ * @brief Empty host stub, included by project_config.h
+ */
+
+#pragma once
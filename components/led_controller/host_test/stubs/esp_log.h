@@ -0,0 +1,13 @@
+/**
+ * @file esp_log.h
+ * @brief Host stub of the ESP-IDF logging API for host tests
+ */
+
+#pragma once
+
+#define ESP_LOG_INFO 3
+
+#define ESP_LOGE(tag, fmt, ...) ((void)(tag))
+#define ESP_LOGW(tag, fmt, ...) ((void)(tag))
+#define ESP_LOGI(tag, fmt, ...) ((void)(tag))
+#define ESP_LOGD(tag, fmt, ...) ((void)(tag))
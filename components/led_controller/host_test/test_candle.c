@@ -0,0 +1,65 @@
+/**
+ * @file test_candle.c
+ * @brief Host test: run_candle() output is bit-exact with the reference
+ */
+
+#include <string.h>
+
+#include "candle.h"
+#include "candle_reference.h"
+#include "test_utils.h"
+
+/// @brief Largest pixel buffer exercised by the test
+#define MAX_PIXELS 300
+
+/**
+ * @brief Run both implementations once and compare the full buffers
+ */
+static void compare_frame(effect_param_t *params, uint64_t time_ms,
+                          uint16_t num_pixels) {
+    color_t expected[MAX_PIXELS];
+    color_t actual[MAX_PIXELS];
+    memset(expected, 0, sizeof(expected));
+    memset(actual, 0, sizeof(actual));
+
+    run_candle_reference(params, 4, 255, time_ms, expected, num_pixels);
+    run_candle(params, 4, 255, time_ms, actual, num_pixels);
+
+    if (memcmp(expected, actual, sizeof(expected)) != 0) {
+        printf("mismatch: speed=%d segments=%d time_ms=%llu pixels=%u\n",
+               params[0].value, params[3].value,
+               (unsigned long long)time_ms, num_pixels);
+        test_failures++;
+    }
+}
+
+int main(void) {
+    // Times around table wraps, 32-bit boundaries and long uptimes
+    const uint64_t base_times[] = {
+        0, 1, 9, 877, 10485, 10486, 10487, 123456, 86400000ULL,
+        0xFFFFFFFFULL, 0x100000000ULL, 0x123456789ABCULL,
+    };
+    const uint16_t pixel_counts[] = {1, 3, 48, 82, MAX_PIXELS};
+    uint32_t frames = 0;
+
+    effect_param_t params[4];
+    memcpy(params, params_candle, sizeof(params));
+
+    for (int16_t speed = 0; speed <= 20; speed++) {
+        for (int16_t segments = 0; segments <= 40; segments++) {
+            for (size_t t = 0; t < sizeof(base_times) / sizeof(base_times[0]); t++) {
+                for (size_t p = 0; p < sizeof(pixel_counts) / sizeof(pixel_counts[0]); p++) {
+                    for (uint64_t step = 0; step < 100; step += 7) {
+                        params[0].value = speed;
+                        params[3].value = segments;
+                        compare_frame(params, base_times[t] + step, pixel_counts[p]);
+                        frames++;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("compared %u frames\n", frames);
+    return TEST_RESULT();
+}
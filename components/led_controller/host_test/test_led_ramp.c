@@ -0,0 +1,304 @@
+/**
+ * @file test_led_ramp.c
+ * @brief Host test: long-duration fixed-point ramp engine
+ */
+
+#include <stdbool.h>
+
+#include "led_ramp.h"
+#include "project_config.h"
+#include "test_utils.h"
+
+/// @brief Ramps are sampled at the firmware's render interval
+#define FRAME_MS LED_RENDER_INTERVAL_MS
+
+/// @brief Sunrise length exercised by the tests
+#define SUNRISE_MS ((uint32_t)SUNRISE_DURATION_MIN * 60u * 1000u)
+
+/// @brief Arbitrary non-zero uptime at which the ramps start
+#define START_MS 123456789ull
+
+/**
+ * @brief Sample a ramp every frame until it finishes and check its shape
+ *
+ * @param start Start value (16.16)
+ * @param end End value (16.16)
+ * @param duration_ms Ramp duration
+ * @param frame_ms Sampling period
+ */
+static void check_ramp(int32_t start, int32_t end, uint32_t duration_ms, uint32_t frame_ms) {
+    led_ramp_t ramp;
+    led_ramp_start(&ramp, start, end, duration_ms, START_MS, false);
+    CHECK(ramp.active);
+
+    // Largest legitimate change per frame, plus one for truncation
+    int64_t delta = (int64_t)end - start;
+    int64_t magnitude = delta < 0 ? -delta : delta;
+    int64_t max_step = magnitude * frame_ms / duration_ms + 1;
+
+    int32_t lo = start < end ? start : end;
+    int32_t hi = start < end ? end : start;
+    int32_t prev = led_ramp_update(&ramp, START_MS);
+    CHECK_EQ(prev, start);
+
+    uint64_t now = START_MS;
+    int64_t worst_step = 0;
+    while (ramp.active) {
+        now += frame_ms;
+        int32_t value = led_ramp_update(&ramp, now);
+        int64_t step = (int64_t)value - prev;
+
+        // Monotonic in the ramp direction and never past either end
+        CHECK(delta >= 0 ? step >= 0 : step <= 0);
+        CHECK(value >= lo && value <= hi);
+        if (step < 0) step = -step;
+        if (step > worst_step) worst_step = step;
+        prev = value;
+    }
+
+    CHECK(worst_step <= max_step);
+    CHECK_EQ(prev, end);
+    CHECK(now - START_MS >= duration_ms);
+    CHECK(now - START_MS < duration_ms + frame_ms);
+}
+
+static void test_sunrise_length_up(void) {
+    check_ramp(LED_RAMP_Q16(0), LED_RAMP_Q16(255), SUNRISE_MS, FRAME_MS);
+    check_ramp(LED_RAMP_Q16(10), LED_RAMP_Q16(75), SUNRISE_MS, FRAME_MS);
+    check_ramp(LED_RAMP_Q16(0), LED_RAMP_Q16(9), SUNRISE_MS, FRAME_MS);
+
+    // Over a full sunrise a full-scale ramp moves well under 1/256 LSB per frame
+    led_ramp_t ramp;
+    led_ramp_start(&ramp, LED_RAMP_Q16(0), LED_RAMP_Q16(255), SUNRISE_MS, START_MS, false);
+    int32_t first = led_ramp_update(&ramp, START_MS + FRAME_MS);
+    CHECK(first > 0);
+    CHECK(first < 256);
+}
+
+static void test_sunrise_length_down(void) {
+    check_ramp(LED_RAMP_Q16(255), LED_RAMP_Q16(0), SUNRISE_MS, FRAME_MS);
+    check_ramp(LED_RAMP_Q16(75), LED_RAMP_Q16(10), SUNRISE_MS, FRAME_MS);
+    check_ramp(LED_RAMP_Q16(9), LED_RAMP_Q16(0), SUNRISE_MS, FRAME_MS);
+}
+
+static void test_irregular_and_long(void) {
+    // Slow frames and an 8 hour ramp still land exactly on the end value
+    check_ramp(LED_RAMP_Q16(0), LED_RAMP_Q16(255), SUNRISE_MS, 1000);
+    check_ramp(LED_RAMP_Q16(255), LED_RAMP_Q16(1), 8u * 60u * 60u * 1000u, 997);
+    check_ramp(LED_RAMP_Q16(3), LED_RAMP_Q16(4), 7, 1);
+
+    // A time before the start (clock read earlier) reads the start value
+    led_ramp_t ramp;
+    led_ramp_start(&ramp, LED_RAMP_Q16(20), LED_RAMP_Q16(200), SUNRISE_MS, START_MS, false);
+    CHECK_EQ(led_ramp_update(&ramp, START_MS - 5), LED_RAMP_Q16(20));
+
+    // A frame far past the end finishes immediately
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + 10ull * SUNRISE_MS), LED_RAMP_Q16(200));
+    CHECK(!ramp.active);
+}
+
+static void test_zero_duration(void) {
+    led_ramp_t ramp;
+    led_ramp_start(&ramp, LED_RAMP_Q16(10), LED_RAMP_Q16(200), 0, START_MS, false);
+    CHECK(!ramp.active);
+    CHECK(!led_ramp_engaged(&ramp));
+    CHECK_EQ(led_ramp_update(&ramp, START_MS), LED_RAMP_Q16(200));
+
+    led_ramp_start(&ramp, LED_RAMP_Q16(200), LED_RAMP_Q16(10), 0, START_MS, true);
+    CHECK(!ramp.active);
+    CHECK(led_ramp_engaged(&ramp));
+    CHECK_EQ(led_ramp_update(&ramp, START_MS), LED_RAMP_Q16(10));
+}
+
+static void test_hold_and_cancel(void) {
+    led_ramp_t ramp;
+
+    // Without hold the ramp releases its output once finished
+    led_ramp_start(&ramp, LED_RAMP_Q16(0), LED_RAMP_Q16(100), 1000, START_MS, false);
+    CHECK(led_ramp_engaged(&ramp));
+    led_ramp_update(&ramp, START_MS + 1000);
+    CHECK(!led_ramp_engaged(&ramp));
+
+    // With hold it keeps returning the end value until cancelled
+    led_ramp_start(&ramp, LED_RAMP_Q16(100), LED_RAMP_Q16(10), 1000, START_MS, true);
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + 1000), LED_RAMP_Q16(10));
+    CHECK(!ramp.active);
+    CHECK(led_ramp_engaged(&ramp));
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + 60000), LED_RAMP_Q16(10));
+    CHECK(led_ramp_engaged(&ramp));
+    led_ramp_cancel(&ramp);
+    CHECK(!led_ramp_engaged(&ramp));
+
+    // Cancelling mid-ramp stops it and releases the hold
+    led_ramp_start(&ramp, LED_RAMP_Q16(100), LED_RAMP_Q16(10), 1000, START_MS, true);
+    led_ramp_update(&ramp, START_MS + 500);
+    led_ramp_cancel(&ramp);
+    CHECK(!ramp.active);
+    CHECK(!led_ramp_engaged(&ramp));
+}
+
+static void test_freeze(void) {
+    led_ramp_t ramp;
+
+    // Frozen mid-ramp: keeps the value shown at that moment, not the end
+    led_ramp_start(&ramp, LED_RAMP_Q16(0), LED_RAMP_Q16(9), SUNRISE_MS, START_MS, false);
+    int32_t shown = led_ramp_update(&ramp, START_MS + SUNRISE_MS / 3);
+    led_ramp_freeze(&ramp, START_MS + SUNRISE_MS / 3);
+    CHECK(!ramp.active);
+    CHECK(led_ramp_engaged(&ramp));
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + SUNRISE_MS / 3), shown);
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + 10ull * SUNRISE_MS), shown);
+    CHECK(led_ramp_engaged(&ramp));
+
+    // Freezing again, or freezing a held end value, changes nothing
+    led_ramp_freeze(&ramp, START_MS + 20ull * SUNRISE_MS);
+    CHECK_EQ(led_ramp_update(&ramp, START_MS), shown);
+    led_ramp_start(&ramp, LED_RAMP_Q16(9), LED_RAMP_Q16(0), 1000, START_MS, true);
+    led_ramp_update(&ramp, START_MS + 2000);
+    led_ramp_freeze(&ramp, START_MS + 3000);
+    CHECK(led_ramp_engaged(&ramp));
+    CHECK_EQ(led_ramp_update(&ramp, START_MS + 4000), LED_RAMP_Q16(0));
+
+    // Only a cancel releases a frozen value
+    led_ramp_cancel(&ramp);
+    CHECK(!led_ramp_engaged(&ramp));
+
+    // A finished ramp without hold, or a cancelled one, stays released
+    led_ramp_start(&ramp, LED_RAMP_Q16(0), LED_RAMP_Q16(9), 1000, START_MS, false);
+    led_ramp_update(&ramp, START_MS + 1000);
+    led_ramp_freeze(&ramp, START_MS + 1500);
+    CHECK(!led_ramp_engaged(&ramp));
+    led_ramp_start(&ramp, LED_RAMP_Q16(0), LED_RAMP_Q16(9), 1000, START_MS, true);
+    led_ramp_cancel(&ramp);
+    led_ramp_freeze(&ramp, START_MS + 500);
+    CHECK(!led_ramp_engaged(&ramp));
+}
+
+/// @brief Frames in one dither cycle
+#define DITHER_CYCLE (1 << LED_RAMP_DITHER_BITS)
+
+/// @brief Offset between adjacent dither values
+#define DITHER_STEP (256 >> LED_RAMP_DITHER_BITS)
+
+static void test_dither_sequence(void) {
+    CHECK_EQ(led_ramp_dither(0), 0);
+    CHECK_EQ(led_ramp_dither(1), 128);
+    CHECK_EQ(led_ramp_dither(2), 64);
+    CHECK_EQ(led_ramp_dither(3), 192);
+    CHECK_EQ(led_ramp_dither(DITHER_CYCLE - 1), 256 - DITHER_STEP);
+
+    // The sequence repeats every cycle, whatever the counter width
+    for (int f = 0; f < 256; f++) {
+        CHECK_EQ(led_ramp_dither((uint8_t)f), led_ramp_dither((uint8_t)(f % DITHER_CYCLE)));
+    }
+
+    // Every aligned run of 2^k frames spreads its offsets one per bucket
+    for (int k = 1; k <= LED_RAMP_DITHER_BITS; k++) {
+        int run = 1 << k;
+        for (int first = 0; first < 256; first += run) {
+            bool seen[256] = {false};
+            for (int f = first; f < first + run; f++) {
+                int bucket = led_ramp_dither((uint8_t)f) >> (8 - k);
+                CHECK(!seen[bucket]);
+                seen[bucket] = true;
+            }
+        }
+    }
+}
+
+static void test_scale_without_dither(void) {
+    // Whole levels match the regular (value * brightness) / 255 path
+    for (uint32_t value = 0; value < 256; value++) {
+        for (uint32_t brightness = 0; brightness < 256; brightness++) {
+            CHECK_EQ(led_ramp_scale((uint8_t)value, (uint16_t)(brightness << 8), 0),
+                     (value * brightness) / 255);
+        }
+    }
+
+    // Out of range levels saturate instead of wrapping
+    CHECK_EQ(led_ramp_scale(255, 0xFFFF, 255), 255);
+    CHECK_EQ(led_ramp_scale(255, 255 << 8, 255), 255);
+}
+
+static void test_scale_dither_average(void) {
+    // Over one cycle each channel averages its 8.8 value to the dither
+    // resolution, so levels between two 8-bit steps are visible, also for
+    // channels at 255
+    for (uint32_t value = 0; value < 256; value++) {
+        for (uint32_t level = 0; level <= (255 << 8); level += 61) {
+            uint32_t sum = 0;
+            uint8_t lo = 255;
+            uint8_t hi = 0;
+            for (int frame = 0; frame < DITHER_CYCLE; frame++) {
+                uint8_t out = led_ramp_scale((uint8_t)value, (uint16_t)level,
+                                             led_ramp_dither((uint8_t)frame));
+                sum += out;
+                if (out < lo) lo = out;
+                if (out > hi) hi = out;
+            }
+            CHECK_EQ(sum, (value * level) / 255 / DITHER_STEP);
+            CHECK(hi - lo <= 1);
+        }
+    }
+
+    // A quarter LSB on a full channel: one frame in four steps up
+    uint32_t sum = 0;
+    for (int frame = 0; frame < 4; frame++) {
+        sum += led_ramp_scale(255, (100 << 8) + 64, led_ramp_dither((uint8_t)frame));
+    }
+    CHECK_EQ(sum, 4 * 100 + 1);
+}
+
+static void test_dither_toggle_period(void) {
+    // A dithered level must not sit still for long and then bump for a
+    // single frame: the longest run between toggles stays within one cycle
+    int longest_run = 0;
+    for (uint32_t value = 1; value < 256; value++) {
+        for (uint32_t level = 0; level <= (255 << 8); level += 7) {
+            uint8_t out[DITHER_CYCLE];
+            bool toggles = false;
+            for (int frame = 0; frame < DITHER_CYCLE; frame++) {
+                out[frame] = led_ramp_scale((uint8_t)value, (uint16_t)level,
+                                            led_ramp_dither((uint8_t)frame));
+                toggles |= out[frame] != out[0];
+            }
+            if (!toggles) {
+                continue;
+            }
+
+            // The output repeats every cycle, so runs wrap around its end
+            for (int first = 0; first < DITHER_CYCLE; first++) {
+                int run = 1;
+                while (out[(first + run) % DITHER_CYCLE] == out[first]) {
+                    run++;
+                }
+                if (run > longest_run) {
+                    longest_run = run;
+                }
+            }
+        }
+    }
+    CHECK(longest_run < DITHER_CYCLE);
+    CHECK(longest_run * LED_RENDER_INTERVAL_MS <= 160);
+
+    // The faintest step at the dark start of a sunrise repeats every cycle
+    int bumps = 0;
+    for (int frame = 0; frame < 4 * DITHER_CYCLE; frame++) {
+        bumps += led_ramp_scale(255, DITHER_STEP, led_ramp_dither((uint8_t)frame));
+    }
+    CHECK_EQ(bumps, 4);
+}
+
+int main(void) {
+    test_sunrise_length_up();
+    test_sunrise_length_down();
+    test_irregular_and_long();
+    test_zero_duration();
+    test_hold_and_cancel();
+    test_freeze();
+    test_dither_sequence();
+    test_scale_without_dither();
+    test_scale_dither_average();
+    test_dither_toggle_period();
+    return TEST_RESULT();
+}
@@ -0,0 +1,236 @@
+/**
+ * @file test_power_sequencer.c
+ * @brief Host test: relay/LED power sequencing with a mock GPIO and driver
+ */
+
+#include <string.h>
+
+#include "power_sequencer.h"
+#include "test_utils.h"
+
+/// @brief Settle delay used by the tests
+#define TEST_SETTLE_MS 50
+
+/// @brief Black frame attempts used by the tests
+#define TEST_LATCH_ATTEMPTS 3
+
+/**
+ * @brief Events recorded by the mocks, in call order
+ */
+typedef enum {
+    EV_RELAY_ON,        ///< relay_on hook called
+    EV_RELAY_OFF,       ///< relay_off hook called (delayed off armed)
+    EV_GPIO_LOW,        ///< Delayed off expired, GPIO driven low
+    EV_DELAY,           ///< delay_ms hook called
+    EV_BLACK_LATCHED,   ///< Black frame sent and acknowledged
+    EV_BLACK_LOST,      ///< Black frame sent, no acknowledgement
+    EV_FRAME,           ///< Render loop produced an effect frame
+} event_t;
+
+/**
+ * @brief Mock relay GPIO and LED driver
+ */
+typedef struct {
+    event_t events[64];        ///< Event log
+    int num_events;            ///< Number of logged events
+    int gpio_level;            ///< Relay GPIO level
+    bool off_pending;          ///< Relay-off timer running
+    int latch_failures;        ///< Black frames to drop before acknowledging
+    uint32_t last_delay_ms;    ///< Argument of the last delay
+    bool black_while_unpowered; ///< A black frame was sent with the GPIO low
+    bool frame_while_unpowered; ///< An effect frame was sent with the GPIO low
+} mock_t;
+
+static mock_t mock;
+
+static void log_event(event_t ev) {
+    if (mock.num_events < (int)(sizeof(mock.events) / sizeof(mock.events[0]))) {
+        mock.events[mock.num_events++] = ev;
+    }
+}
+
+static void mock_relay_on(void *ctx) {
+    // Like relay_controller_on(): cancel a pending off, drive the pin high
+    mock.off_pending = false;
+    mock.gpio_level = 1;
+    log_event(EV_RELAY_ON);
+}
+
+static void mock_relay_off(void *ctx) {
+    // Like relay_controller_off(): only arms the delayed-off timer
+    mock.off_pending = true;
+    log_event(EV_RELAY_OFF);
+}
+
+static void mock_delay_ms(void *ctx, uint32_t ms) {
+    mock.last_delay_ms = ms;
+    log_event(EV_DELAY);
+}
+
+static bool mock_send_black_frame(void *ctx) {
+    if (mock.gpio_level == 0) {
+        mock.black_while_unpowered = true;
+    }
+    if (mock.latch_failures > 0) {
+        mock.latch_failures--;
+        log_event(EV_BLACK_LOST);
+        return false;
+    }
+    log_event(EV_BLACK_LATCHED);
+    return true;
+}
+
+/**
+ * @brief Expire the relay-off timer, as the FreeRTOS timer would
+ */
+static void mock_relay_timer_expire(void) {
+    if (mock.off_pending) {
+        mock.off_pending = false;
+        mock.gpio_level = 0;
+        log_event(EV_GPIO_LOW);
+    }
+}
+
+static void setup(power_seq_t *seq) {
+    memset(&mock, 0, sizeof(mock));
+    const power_seq_hooks_t hooks = {
+        .relay_on = mock_relay_on,
+        .relay_off = mock_relay_off,
+        .delay_ms = mock_delay_ms,
+        .send_black_frame = mock_send_black_frame,
+        .ctx = NULL,
+    };
+    power_seq_init(seq, &hooks, TEST_SETTLE_MS, TEST_LATCH_ATTEMPTS);
+}
+
+/**
+ * @brief One render loop iteration, as led_render_task runs it
+ */
+static power_seq_action_t step(power_seq_t *seq, bool power_needed, bool output_black) {
+    power_seq_action_t action = power_seq_update(seq, power_needed, output_black);
+    if (action != POWER_SEQ_SUSPEND) {
+        if (mock.gpio_level == 0) {
+            mock.frame_while_unpowered = true;
+        }
+        log_event(EV_FRAME);
+    }
+    return action;
+}
+
+static void test_power_up_order(void) {
+    power_seq_t seq;
+    setup(&seq);
+
+    CHECK_EQ(step(&seq, true, true), POWER_SEQ_POWERED_UP);
+    CHECK_EQ(mock.num_events, 4);
+    CHECK_EQ(mock.events[0], EV_RELAY_ON);
+    CHECK_EQ(mock.events[1], EV_DELAY);
+    CHECK_EQ(mock.last_delay_ms, TEST_SETTLE_MS);
+    CHECK_EQ(mock.events[2], EV_BLACK_LATCHED);
+    CHECK_EQ(mock.events[3], EV_FRAME);
+    CHECK_EQ(seq.state, POWER_STATE_ON);
+
+    // Steady state renders without touching the relay or driver hooks
+    CHECK_EQ(step(&seq, true, false), POWER_SEQ_RENDER);
+    CHECK_EQ(mock.num_events, 5);
+    CHECK(!mock.black_while_unpowered);
+    CHECK(!mock.frame_while_unpowered);
+}
+
+static void test_power_down_order(void) {
+    power_seq_t seq;
+    setup(&seq);
+    step(&seq, true, true);
+    mock.num_events = 0;
+
+    // Fade-out still running: keep rendering, relay untouched
+    CHECK_EQ(step(&seq, false, false), POWER_SEQ_RENDER);
+    CHECK_EQ(mock.num_events, 1);
+    CHECK_EQ(mock.events[0], EV_FRAME);
+
+    // Faded to black: latched black frame first, then relay off
+    CHECK_EQ(step(&seq, false, true), POWER_SEQ_SUSPEND);
+    CHECK_EQ(mock.num_events, 3);
+    CHECK_EQ(mock.events[1], EV_BLACK_LATCHED);
+    CHECK_EQ(mock.events[2], EV_RELAY_OFF);
+    CHECK_EQ(seq.state, POWER_STATE_OFF);
+
+    mock_relay_timer_expire();
+    CHECK_EQ(mock.gpio_level, 0);
+    CHECK(!mock.black_while_unpowered);
+}
+
+static void test_no_frames_while_off(void) {
+    power_seq_t seq;
+    setup(&seq);
+
+    for (int i = 0; i < 100; i++) {
+        CHECK_EQ(step(&seq, false, true), POWER_SEQ_SUSPEND);
+    }
+    CHECK_EQ(mock.num_events, 0);
+    CHECK_EQ(mock.gpio_level, 0);
+
+    // Same after a full on/off cycle with the relay timer expired
+    step(&seq, true, true);
+    step(&seq, false, true);
+    mock_relay_timer_expire();
+    int events_after_off = mock.num_events;
+    for (int i = 0; i < 100; i++) {
+        CHECK_EQ(step(&seq, false, true), POWER_SEQ_SUSPEND);
+    }
+    CHECK_EQ(mock.num_events, events_after_off);
+    CHECK(!mock.frame_while_unpowered);
+}
+
+static void test_reon_during_relay_off_delay(void) {
+    power_seq_t seq;
+    setup(&seq);
+    step(&seq, true, true);
+    step(&seq, false, true);
+    CHECK(mock.off_pending);
+    mock.num_events = 0;
+
+    // ON arrives before the relay-off timer expired
+    CHECK_EQ(step(&seq, true, true), POWER_SEQ_POWERED_UP);
+    CHECK(!mock.off_pending);
+    CHECK_EQ(mock.events[0], EV_RELAY_ON);
+    CHECK_EQ(mock.events[1], EV_DELAY);
+    CHECK_EQ(mock.events[2], EV_BLACK_LATCHED);
+    CHECK_EQ(mock.events[3], EV_FRAME);
+
+    // The cancelled timer must not cut power later
+    mock_relay_timer_expire();
+    CHECK_EQ(mock.gpio_level, 1);
+    CHECK_EQ(step(&seq, true, false), POWER_SEQ_RENDER);
+    CHECK(!mock.frame_while_unpowered);
+}
+
+static void test_latch_retry_and_give_up(void) {
+    power_seq_t seq;
+    setup(&seq);
+
+    // Two lost acknowledgements, the third attempt latches
+    mock.latch_failures = 2;
+    CHECK_EQ(step(&seq, true, true), POWER_SEQ_POWERED_UP);
+    CHECK_EQ(mock.events[2], EV_BLACK_LOST);
+    CHECK_EQ(mock.events[3], EV_BLACK_LOST);
+    CHECK_EQ(mock.events[4], EV_BLACK_LATCHED);
+    CHECK_EQ(mock.events[5], EV_FRAME);
+
+    // Driver never acknowledges: the relay still follows the OFF request
+    mock.num_events = 0;
+    mock.latch_failures = 100;
+    CHECK_EQ(step(&seq, false, true), POWER_SEQ_SUSPEND);
+    CHECK_EQ(mock.num_events, TEST_LATCH_ATTEMPTS + 1);
+    CHECK_EQ(mock.events[TEST_LATCH_ATTEMPTS], EV_RELAY_OFF);
+    CHECK_EQ(seq.state, POWER_STATE_OFF);
+}
+
+int main(void) {
+    test_power_up_order();
+    test_power_down_order();
+    test_no_frames_while_off();
+    test_reon_during_relay_off_delay();
+    test_latch_retry_and_give_up();
+    return TEST_RESULT();
+}
@@ -0,0 +1,42 @@
+/**
+ * @file test_utils.h
+ * @brief Minimal assertion helpers for the led_controller host tests
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+/// @brief Number of failed checks in the current test executable
+static int test_failures = 0;
+
+/**
+ * @brief Record a failure when the condition is false, keep running
+ */
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);    \
+            test_failures++;                                                   \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Compare two integers, printing both values on failure
+ */
+#define CHECK_EQ(a, b)                                                         \
+    do {                                                                       \
+        long long _a = (long long)(a), _b = (long long)(b);                    \
+        if (_a != _b) {                                                        \
+            printf("%s:%d: CHECK_EQ failed: %s == %s (%lld != %lld)\n",       \
+                   __FILE__, __LINE__, #a, #b, _a, _b);                        \
+            test_failures++;                                                   \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Report the result and return the process exit code
+ */
+#define TEST_RESULT()                                                          \
+    (printf("%s: %s\n", __FILE__, test_failures ? "FAILED" : "OK"),            \
+     test_failures ? 1 : 0)
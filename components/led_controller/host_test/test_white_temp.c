@@ -0,0 +1,81 @@
+/**
+ * @file test_white_temp.c
+ * @brief Host test: fractional white temperature lookup
+ */
+
+#include <string.h>
+
+#include "white_temp.h"
+#include "white_temp_color.h"
+#include "test_utils.h"
+
+/// @brief Convert an integer temperature index to 16.16 fixed point
+#define TEMP_Q16(x) ((int32_t)(x) * 65536)
+
+/**
+ * @brief Color produced by run_white_temp() for an integer temperature
+ */
+static rgb_t effect_color(int16_t temp) {
+    effect_param_t param = params_white_temp[0];
+    param.value = temp;
+    color_t pixel;
+    memset(&pixel, 0, sizeof(pixel));
+    run_white_temp(&param, 1, 255, 0, &pixel, 1);
+    return pixel.rgb;
+}
+
+static void check_rgb(rgb_t actual, uint8_t r, uint8_t g, uint8_t b) {
+    CHECK_EQ(actual.r, r);
+    CHECK_EQ(actual.g, g);
+    CHECK_EQ(actual.b, b);
+}
+
+static void test_table_ends(void) {
+    rgb_t warmest = effect_color(0);
+    rgb_t coolest = effect_color(9);
+
+    check_rgb(white_temp_rgb(TEMP_Q16(0)), warmest.r, warmest.g, warmest.b);
+    check_rgb(white_temp_rgb(TEMP_Q16(9)), coolest.r, coolest.g, coolest.b);
+
+    // Out of range values clamp instead of reading past the table
+    check_rgb(white_temp_rgb(-1), warmest.r, warmest.g, warmest.b);
+    check_rgb(white_temp_rgb(TEMP_Q16(-5)), warmest.r, warmest.g, warmest.b);
+    check_rgb(white_temp_rgb(TEMP_Q16(9) + 1), coolest.r, coolest.g, coolest.b);
+    check_rgb(white_temp_rgb(TEMP_Q16(100)), coolest.r, coolest.g, coolest.b);
+    check_rgb(white_temp_rgb(INT32_MAX), coolest.r, coolest.g, coolest.b);
+}
+
+static void test_integer_values_match_effect(void) {
+    for (int16_t temp = 0; temp <= 9; temp++) {
+        rgb_t expected = effect_color(temp);
+        check_rgb(white_temp_rgb(TEMP_Q16(temp)), expected.r, expected.g, expected.b);
+    }
+}
+
+static void test_fractional_values(void) {
+    // Halfway between {255, 120, 0} and {255, 130, 30}
+    check_rgb(white_temp_rgb(TEMP_Q16(0) + 32768), 255, 125, 15);
+    // Halfway between {255, 255, 255} and {201, 226, 255}, truncated toward entry 7
+    check_rgb(white_temp_rgb(TEMP_Q16(7) + 32768), 228, 241, 255);
+    // Fractions below 1/256 do not move the color yet
+    check_rgb(white_temp_rgb(TEMP_Q16(3) + 255), 255, 160, 80);
+
+    // Every step within a segment stays between its two table entries
+    for (int16_t temp = 0; temp < 9; temp++) {
+        rgb_t a = effect_color(temp);
+        rgb_t b = effect_color(temp + 1);
+        for (int32_t frac = 0; frac < 65536; frac += 97) {
+            rgb_t c = white_temp_rgb(TEMP_Q16(temp) + frac);
+            CHECK(c.r >= (a.r < b.r ? a.r : b.r) && c.r <= (a.r > b.r ? a.r : b.r));
+            CHECK(c.g >= (a.g < b.g ? a.g : b.g) && c.g <= (a.g > b.g ? a.g : b.g));
+            CHECK(c.b >= (a.b < b.b ? a.b : b.b) && c.b <= (a.b > b.b ? a.b : b.b));
+        }
+    }
+}
+
+int main(void) {
+    test_table_ends();
+    test_integer_values_match_effect();
+    test_fractional_values();
+    return TEST_RESULT();
+}
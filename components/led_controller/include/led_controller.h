@@ -36,6 +36,7 @@ typedef struct {
     color_t *pixels;           ///< Pointer to the buffer of pixel data
     uint16_t num_pixels;       ///< Number of pixels in the buffer
     color_mode_t mode;         ///< The color mode of the pixel data (RGB or HSV)
+    bool sync;                 ///< Signal led_driver_wait_latched() once this frame is latched
 } led_strip_t;
 
 /**
@@ -0,0 +1,141 @@
+/**
+ * @file led_ramp.h
+ * @brief Long-duration fixed-point ramp engine
+ *
+ * @details This header provides a time-driven linear ramp for slow transitions
+ *          such as sunrise and sunset. Values are 16.16 fixed point so that
+ *          ramps lasting tens of minutes keep sub-LSB resolution instead of
+ *          stepping or stalling on 8-bit increments.
+ *
+ *          The LEDs still take 8-bit channels. The fraction reaches them
+ *          through temporal dithering: led_ramp_scale() adds a per-frame
+ *          ordered offset before truncating, so over a short dither cycle
+ *          each channel averages its value to 1/2^LED_RAMP_DITHER_BITS LSB.
+ *
+ * @author Your Name
+ * @date 2024-03-15
+ * @version 1.0
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Fractional output bits resolved by temporal dithering
+ *
+ * @details The dither cycle is 2^LED_RAMP_DITHER_BITS frames. A longer cycle
+ *          would resolve finer levels, but at the render interval a small
+ *          fraction would show as a lone one-frame blink every few seconds,
+ *          most visibly on the dark start of a sunrise. Three bits give an
+ *          8-frame cycle (80 ms at 10 ms per frame).
+ */
+#define LED_RAMP_DITHER_BITS 3
+
+/**
+ * @brief Convert an integer to 16.16 fixed point
+ */
+#define LED_RAMP_Q16(x) ((int32_t)(x) * 65536)
+
+/**
+ * @brief Linear ramp state
+ *
+ * @details The value is recomputed from the elapsed time on every update, so
+ *          irregular frame timing never accumulates error. The rate is kept
+ *          with 48 fractional bits, so even a ramp lasting days stays within
+ *          one 16.16 unit of the exact line and never jumps on its last frame.
+ *
+ *          A ramp started with `hold` stays engaged at its end value once
+ *          finished, until cancelled. This lets a ramp drive the output to a
+ *          level that is never written back to the saved settings.
+ */
+typedef struct {
+    int32_t start;             ///< Start value (16.16 fixed point)
+    int32_t end;               ///< End value (16.16 fixed point)
+    int64_t rate;              ///< Change per millisecond (16.48 fixed point)
+    uint64_t start_ms;         ///< Time the ramp was started in milliseconds
+    uint32_t duration_ms;      ///< Total ramp duration in milliseconds
+    bool active;               ///< Whether the ramp is still running
+    bool hold;                 ///< Keep the end value engaged once finished
+} led_ramp_t;
+
+/**
+ * @brief Start a ramp
+ *
+ * @param[out] ramp Ramp state to initialize
+ * @param[in] start Start value (16.16 fixed point)
+ * @param[in] end End value (16.16 fixed point)
+ * @param[in] duration_ms Ramp duration in milliseconds
+ * @param[in] now_ms Current time in milliseconds
+ * @param[in] hold Stay engaged at the end value once finished
+ *
+ * @note A zero duration completes the ramp immediately at the end value
+ * @note |end - start| must stay below LED_RAMP_Q16(16384)
+ */
+void led_ramp_start(led_ramp_t *ramp, int32_t start, int32_t end,
+                    uint32_t duration_ms, uint64_t now_ms, bool hold);
+
+/**
+ * @brief Get the ramp value at the given time
+ *
+ * @param[in,out] ramp Ramp state
+ * @param[in] now_ms Current time in milliseconds
+ * @return Current value (16.16 fixed point)
+ *
+ * @note Returns the end value and clears `active` once the duration elapsed
+ */
+int32_t led_ramp_update(led_ramp_t *ramp, uint64_t now_ms);
+
+/**
+ * @brief Check whether a ramp still owns its output
+ *
+ * @param[in] ramp Ramp state
+ * @return true while running, or while holding its end value
+ */
+bool led_ramp_engaged(const led_ramp_t *ramp);
+
+/**
+ * @brief Stop a ramp where it is and hold that value
+ *
+ * @param[in,out] ramp Ramp state
+ * @param[in] now_ms Current time in milliseconds
+ *
+ * @note Does nothing if the ramp is not engaged. The frozen value stays
+ *       engaged until led_ramp_cancel()
+ */
+void led_ramp_freeze(led_ramp_t *ramp, uint64_t now_ms);
+
+/**
+ * @brief Get the ordered dither offset for a frame
+ *
+ * @param[in] frame Frame counter, only its low LED_RAMP_DITHER_BITS are used
+ * @return Offset (0-255) to pass to led_ramp_scale()
+ *
+ * @note The offset is the bit-reversed counter, so every aligned run of
+ *       2^k frames within the cycle spreads its offsets evenly over 0-255
+ */
+uint8_t led_ramp_dither(uint8_t frame);
+
+/**
+ * @brief Scale a color channel by an 8.8 fixed-point output level
+ *
+ * @param[in] value Channel value (0-255)
+ * @param[in] level Output level (8.8 fixed point, 0-255)
+ * @param[in] dither Ordered dither offset, 0 for plain truncation
+ * @return Scaled channel value
+ *
+ * @note With dither 0 and a whole level this is identical to
+ *       (value * brightness) / 255
+ */
+uint8_t led_ramp_scale(uint8_t value, uint16_t level, uint8_t dither);
+
+/**
+ * @brief Stop a ramp and release a held end value
+ *
+ * @param[in,out] ramp Ramp state
+ *
+ * @note The caller keeps the last value returned by led_ramp_update()
+ */
+void led_ramp_cancel(led_ramp_t *ramp);
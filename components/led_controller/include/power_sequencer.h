@@ -0,0 +1,94 @@
+/**
+ * @file power_sequencer.h
+ * @brief Power sequencing between the relay and the LED output
+ *
+ * @details This header provides the state machine that orders relay
+ *          switching against frames sent to the LED driver. It has no
+ *          FreeRTOS or GPIO dependencies: the relay, the delay and the
+ *          latched black frame are injected as hooks, so the sequence can
+ *          be driven from host tests.
+ *
+ *          Guarantees:
+ *          - Power up: relay on, settle delay, latched black frame, and only
+ *            then the first effect frame.
+ *          - Power down: latched black frame, and only then relay off.
+ *          - While off, no frames are rendered.
+ *
+ *          If the driver does not acknowledge the black frame after all
+ *          attempts, the sequence still proceeds. The relay must follow the
+ *          user's on/off request: a hung driver must not keep the strip
+ *          powered, nor keep it dark after an ON. Such a failure is logged.
+ *
+ * @author Your Name
+ * @date 2024-03-15
+ * @version 1.0
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Power sequencing state
+ */
+typedef enum {
+    POWER_STATE_OFF,             ///< Relay off, rendering suspended
+    POWER_STATE_ON,              ///< Relay on, known first frame sent, rendering active
+} power_state_t;
+
+/**
+ * @brief Action the render loop takes after a sequencer update
+ */
+typedef enum {
+    POWER_SEQ_SUSPEND,           ///< Strip unpowered, block until woken
+    POWER_SEQ_POWERED_UP,        ///< Strip just powered up, render a full frame
+    POWER_SEQ_RENDER,            ///< Strip powered, render normally
+} power_seq_action_t;
+
+/**
+ * @brief Hardware hooks used by the sequencer
+ */
+typedef struct {
+    void (*relay_on)(void *ctx);              ///< Switch the relay on now
+    void (*relay_off)(void *ctx);             ///< Switch the relay off (may be delayed)
+    void (*delay_ms)(void *ctx, uint32_t ms); ///< Block for the given time
+    bool (*send_black_frame)(void *ctx);      ///< Send a black frame, true once latched
+    void *ctx;                                ///< Passed to every hook
+} power_seq_hooks_t;
+
+/**
+ * @brief Power sequencer instance
+ */
+typedef struct {
+    power_seq_hooks_t hooks;     ///< Hardware hooks
+    uint32_t settle_ms;          ///< Delay after relay on before the first frame
+    uint8_t latch_attempts;      ///< Black frame attempts before giving up
+    power_state_t state;         ///< Current power state
+} power_seq_t;
+
+/**
+ * @brief Initialize a power sequencer in the OFF state
+ *
+ * @param[out] seq Sequencer to initialize
+ * @param[in] hooks Hardware hooks, copied into the sequencer
+ * @param[in] settle_ms Delay after relay on before the first frame
+ * @param[in] latch_attempts Black frame attempts per transition (at least 1)
+ *
+ * @note Does not touch the relay; it is expected to be off already
+ */
+void power_seq_init(power_seq_t *seq, const power_seq_hooks_t *hooks,
+                    uint32_t settle_ms, uint8_t latch_attempts);
+
+/**
+ * @brief Advance the power sequence, called once per render iteration
+ *
+ * @param[in,out] seq Sequencer instance
+ * @param[in] power_needed Whether anything needs to be shown
+ * @param[in] output_black Whether the rendered output has faded to black
+ * @return Action the render loop should take
+ *
+ * @note Power up and power down run synchronously inside this call
+ */
+power_seq_action_t power_seq_update(power_seq_t *seq, bool power_needed, bool output_black);
@@ -34,6 +34,9 @@
 // Project specific headers
 #include "led_controller.h"
 #include "led_driver.h"
+#include "led_ramp.h"
+#include "power_sequencer.h"
+#include "white_temp_color.h"
 #include "fsm.h"
 #include "hsv2rgb.h"
 #include "project_config.h"
@@ -106,6 +109,18 @@ static uint16_t active_num_leds = NUM_LEDS;
 /// @brief Power state of LEDs
 static bool is_on = false;
 
+/// @brief Power sequencing between the relay and the LED output, owned by the render task
+static power_seq_t power_seq;
+
+/// @brief Long-duration brightness ramp (sunrise/sunset)
+static led_ramp_t brightness_ramp;
+
+/// @brief Long-duration white temperature ramp, applied while White Temp is active
+static led_ramp_t temperature_ramp;
+
+/// @brief Frame counter for the ordered dither applied while a brightness ramp runs
+static uint8_t dither_frame = 0;
+
 /// @brief Target master brightness (0-255)
 static uint8_t master_brightness = 75;
 
@@ -180,6 +195,9 @@ extern effect_t *effects[];
 /// @brief External reference to effects count from led_effects.c
 extern const uint8_t effects_count;
 
+/// @brief External reference to the white temperature effect from led_effects.c
+extern effect_t effect_white_temp;
+
 //------------------------------------------------------------------------------
 // PRIVATE FUNCTION DECLARATIONS
 //------------------------------------------------------------------------------
@@ -228,6 +246,25 @@ static void brightness_save_callback(TimerHandle_t xTimer);
  */
 static inline rgb_t apply_brightness(rgb_t color, uint8_t brightness);
 
+/**
+ * @brief Start a sunrise: turn on and ramp up brightness and white temperature
+ * 
+ * @param duration_ms Ramp duration in milliseconds
+ */
+static void start_sunrise(uint32_t duration_ms);
+
+/**
+ * @brief Start a sunset: ramp down to minimum brightness and warmest white
+ * 
+ * @param duration_ms Ramp duration in milliseconds
+ */
+static void start_sunset(uint32_t duration_ms);
+
+/**
+ * @brief Interrupt running or held ramps, leaving the output as it is shown
+ */
+static void cancel_ramps(void);
+
 /**
  * @brief Save current parameters to temporary buffer
  */
@@ -252,6 +289,36 @@ static void fill_solid_color(rgb_t color);
  */
 static bool run_feedback_animation(void);
 
+/**
+ * @brief Power sequencer hook: switch the relay on
+ * 
+ * @param ctx Unused
+ */
+static void power_hook_relay_on(void *ctx);
+
+/**
+ * @brief Power sequencer hook: start the delayed relay off
+ * 
+ * @param ctx Unused
+ */
+static void power_hook_relay_off(void *ctx);
+
+/**
+ * @brief Power sequencer hook: block the render task
+ * 
+ * @param ctx Unused
+ * @param ms Delay in milliseconds
+ */
+static void power_hook_delay_ms(void *ctx, uint32_t ms);
+
+/**
+ * @brief Power sequencer hook: send an all-black frame and wait for the latch
+ * 
+ * @param ctx Output frame descriptor (led_strip_t) used by the render task
+ * @return true if the driver latched the frame in time
+ */
+static bool power_hook_send_black_frame(void *ctx);
+
 #if ESP_NOW_ENABLED && IS_MASTER
 /**
  * @brief Send ESP-NOW command
@@ -283,6 +350,62 @@ static inline rgb_t apply_brightness(rgb_t color, uint8_t brightness) {
     return out;
 }
 
+/**
+ * @brief Start a sunrise: turn on and ramp up brightness and white temperature
+ */
+static void start_sunrise(uint32_t duration_ms) {
+    uint64_t now_ms = esp_timer_get_time() / 1000;
+
+    // The wake-up light runs on the white temperature effect
+    for (uint8_t i = 0; i < effects_count; i++) {
+        if (effects[i] == &effect_white_temp) {
+            current_effect_index = i;
+            break;
+        }
+    }
+
+    // Rise from the current output to the saved brightness, and from the
+    // warmest white to the configured temperature. Both end on the saved
+    // values, so the regular settings take over seamlessly once finished
+    led_ramp_start(&brightness_ramp, LED_RAMP_Q16(current_brightness),
+                   LED_RAMP_Q16(master_brightness), duration_ms, now_ms, false);
+    led_ramp_start(&temperature_ramp, LED_RAMP_Q16(0),
+                   LED_RAMP_Q16(effect_white_temp.params[0].value), duration_ms, now_ms, false);
+    is_on = true;
+}
+
+/**
+ * @brief Start a sunset: ramp down to minimum brightness and warmest white
+ */
+static void start_sunset(uint32_t duration_ms) {
+    uint64_t now_ms = esp_timer_get_time() / 1000;
+
+    // Both ramps hold their end values until cancelled, leaving the saved
+    // brightness and temperature untouched as targets for the next sunrise
+    led_ramp_start(&brightness_ramp, LED_RAMP_Q16(current_brightness),
+                   LED_RAMP_Q16(g_min_brightness), duration_ms, now_ms, true);
+    if (effects[current_effect_index] == &effect_white_temp) {
+        // Start from the color being shown, which may be a frozen ramp
+        int32_t temperature = led_ramp_engaged(&temperature_ramp)
+                                  ? led_ramp_update(&temperature_ramp, now_ms)
+                                  : LED_RAMP_Q16(effect_white_temp.params[0].value);
+        led_ramp_start(&temperature_ramp, temperature, LED_RAMP_Q16(0), duration_ms, now_ms, true);
+    } else {
+        led_ramp_cancel(&temperature_ramp);
+    }
+}
+
+/**
+ * @brief Interrupt running or held ramps, leaving the output as it is shown
+ */
+static void cancel_ramps(void) {
+    // current_brightness holds the last ramp level, the regular fade takes over
+    led_ramp_cancel(&brightness_ramp);
+    // The color has no fade of its own, so it stays frozen where it is until
+    // the output fades out or the temperature or effect is changed
+    led_ramp_freeze(&temperature_ramp, esp_timer_get_time() / 1000);
+}
+
 /**
  * @brief Save current parameters to temporary buffer
  */
@@ -379,6 +502,49 @@ static bool run_feedback_animation() {
     return true;
 }
 
+/**
+ * @brief Power sequencer hook: switch the relay on
+ */
+static void power_hook_relay_on(void *ctx) {
+    relay_controller_on();
+}
+
+/**
+ * @brief Power sequencer hook: start the delayed relay off
+ */
+static void power_hook_relay_off(void *ctx) {
+    relay_controller_off();
+}
+
+/**
+ * @brief Power sequencer hook: block the render task
+ */
+static void power_hook_delay_ms(void *ctx, uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+/**
+ * @brief Power sequencer hook: send an all-black frame and wait for the latch
+ */
+static bool power_hook_send_black_frame(void *ctx) {
+    led_strip_t *strip_data = (led_strip_t *)ctx;
+
+    // Drop a stale acknowledgement left behind by an earlier timeout
+    led_driver_wait_latched(0);
+
+    memset(pixel_buffer, 0, sizeof(color_t) * NUM_LEDS);
+    strip_data->mode = COLOR_MODE_RGB;
+    strip_data->sync = true;
+    xQueueOverwrite(q_strip_out, strip_data);
+    strip_data->sync = false;
+
+    if (!led_driver_wait_latched(pdMS_TO_TICKS(LED_POWER_LATCH_TIMEOUT_MS))) {
+        ESP_LOGW(TAG, "Black frame was not latched within %dms", LED_POWER_LATCH_TIMEOUT_MS);
+        return false;
+    }
+    return true;
+}
+
 #if ESP_NOW_ENABLED && IS_MASTER
 /**
  * @brief Send ESP-NOW command
@@ -397,14 +563,14 @@ static void handle_command(const led_command_t *cmd) {
 
     // Do not process other commands if a feedback is active, to avoid conflicts
     if (current_feedback != FEEDBACK_TYPE_NONE &&
-        cmd->cmd < LED_CMD_FEEDBACK_GREEN) {
+        (cmd->cmd < LED_CMD_FEEDBACK_GREEN || cmd->cmd > LED_CMD_BUTTON_ERROR)) {
         return;
     }
 
     switch (cmd->cmd) {
     case LED_CMD_TURN_ON:
-        relay_controller_on(); // Turn on power immediately
-        is_on = true;
+        cancel_ramps();
+        is_on = true; // The render task sequences the relay and first frame
         ESP_LOGI(TAG, "LEDs ON");
         trigger_volatile_save();
 #if ESP_NOW_ENABLED && IS_MASTER
@@ -413,8 +579,8 @@ static void handle_command(const led_command_t *cmd) {
         break;
 
     case LED_CMD_TURN_OFF:
-        relay_controller_off(); // Start the delayed-off timer
-        is_on = false;
+        cancel_ramps();
+        is_on = false; // The render task fades out, latches black, then cuts the relay
         ESP_LOGI(TAG, "LEDs OFF");
         trigger_volatile_save();
 #if ESP_NOW_ENABLED && IS_MASTER
@@ -424,6 +590,8 @@ static void handle_command(const led_command_t *cmd) {
 
     case LED_CMD_SET_EFFECT:
         if (cmd->value >= 0 && cmd->value < effects_count) {
+            cancel_ramps();
+            led_ramp_cancel(&temperature_ramp); // A frozen color belongs to the old effect
             current_effect_index = (uint8_t)cmd->value;
             current_param_index = 0; // Reset param index
             ESP_LOGI(TAG, "Effect set to index: %d (%s)",
@@ -438,6 +606,7 @@ static void handle_command(const led_command_t *cmd) {
 
     case LED_CMD_SET_BRIGHTNESS:
         if (cmd->value >= g_min_brightness && cmd->value <= 255) {
+            cancel_ramps();
             master_brightness = (uint8_t)cmd->value;
             ESP_LOGI(TAG, "Brightness set to: %d", master_brightness);
             // Use the timer to save after a delay, reducing NVS writes
@@ -454,6 +623,9 @@ static void handle_command(const led_command_t *cmd) {
         uint8_t param_idx = cmd->param_idx;
         int16_t param_val = cmd->value;
 
+        // A manual parameter change overrides a running or frozen temperature ramp
+        led_ramp_cancel(&temperature_ramp);
+
         if (current_effect->num_params > 0 &&
             param_idx < current_effect->num_params) {
             effect_param_t *param = &current_effect->params[param_idx];
@@ -490,6 +662,27 @@ static void handle_command(const led_command_t *cmd) {
 #endif
         break;
 
+    case LED_CMD_START_SUNRISE:
+        if (cmd->value > 0) {
+            start_sunrise((uint32_t)cmd->value * 60 * 1000);
+            ESP_LOGI(TAG, "Sunrise started over %d min", cmd->value);
+            trigger_volatile_save();
+#if ESP_NOW_ENABLED && IS_MASTER
+            send_espnow_command(cmd);
+#endif
+        }
+        break;
+
+    case LED_CMD_START_SUNSET:
+        if (cmd->value > 0 && is_on) {
+            start_sunset((uint32_t)cmd->value * 60 * 1000);
+            ESP_LOGI(TAG, "Sunset started over %d min", cmd->value);
+#if ESP_NOW_ENABLED && IS_MASTER
+            send_espnow_command(cmd);
+#endif
+        }
+        break;
+
     case LED_CMD_NEXT_EFFECT_PARAM:
         if (current_effect->num_params > 0) {
             current_param_index = (current_param_index + 1) % current_effect->num_params;
@@ -617,7 +810,11 @@ void led_controller_apply_nvs_data(const volatile_data_t *v_data, const static_d
     led_offset = g_led_offset_begin;
     active_num_leds = NUM_LEDS - (g_led_offset_begin + g_led_offset_end);
 
+    // Wake the render task so a restored ON state starts the power-up sequence
     needs_render = true;
+    if (render_task_handle) {
+        xTaskNotifyGive(render_task_handle);
+    }
 }
 
 /**
@@ -750,7 +947,30 @@ static void led_render_task(void *pv) {
     const TickType_t tick_rate = pdMS_TO_TICKS(LED_RENDER_INTERVAL_MS);
     static bool was_running_feedback = false;
 
+    const power_seq_hooks_t power_hooks = {
+        .relay_on = power_hook_relay_on,
+        .relay_off = power_hook_relay_off,
+        .delay_ms = power_hook_delay_ms,
+        .send_black_frame = power_hook_send_black_frame,
+        .ctx = &strip_data,
+    };
+    power_seq_init(&power_seq, &power_hooks, LED_POWER_SETTLE_MS, LED_POWER_LATCH_ATTEMPTS);
+
     while (1) {
+        // --- Power Sequencing ---
+        // The strip needs power while on, or while a feedback or setup preview is shown
+        bool power_needed = is_on || current_feedback != FEEDBACK_TYPE_NONE || is_in_system_setup;
+        power_seq_action_t power_action =
+            power_seq_update(&power_seq, power_needed, current_brightness == 0);
+        if (power_action == POWER_SEQ_SUSPEND) {
+            // Rendering is suspended until a command wakes the task
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if (power_action == POWER_SEQ_POWERED_UP) {
+            needs_render = true;
+        }
+
         // --- Feedback Animation Rendering ---
         bool is_running_feedback = run_feedback_animation();
         if (was_running_feedback && !is_running_feedback) {
@@ -780,35 +1000,79 @@ static void led_render_task(void *pv) {
 
         // --- Normal Effect Rendering ---
         if (!special_preview_drawn) {
-             uint8_t target_brightness = is_on ? master_brightness : 0;
-            if (current_brightness != target_brightness) {
-                if (current_brightness < target_brightness) current_brightness++;
-                else current_brightness--;
-                needs_render = true;
+            uint64_t now_ms = esp_timer_get_time() / 1000;
+            uint16_t output_level; // Brightness with 8 fractional bits
+            uint8_t dither = 0;    // Ordered dither offset, only while a ramp moves
+
+            if (led_ramp_engaged(&brightness_ramp)) {
+                // Long ramps keep their fraction all the way to the output stage.
+                // A finished sunset holds its level here without touching
+                // master_brightness, which stays the saved sunrise target
+                bool ramp_running = brightness_ramp.active;
+                int32_t level = led_ramp_update(&brightness_ramp, now_ms);
+                current_brightness = (uint8_t)(level >> 16);
+                output_level = (uint16_t)(level >> 8);
+                if (ramp_running) {
+                    // Dithering turns the fraction into a duty cycle between
+                    // adjacent 8-bit values; a held level stays steady
+                    dither = led_ramp_dither(dither_frame++);
+                    needs_render = true;
+                }
+            } else {
+                uint8_t target_brightness = is_on ? master_brightness : 0;
+                if (current_brightness != target_brightness) {
+                    if (current_brightness < target_brightness) current_brightness++;
+                    else current_brightness--;
+                    needs_render = true;
+                }
+                output_level = (uint16_t)current_brightness << 8;
+            }
+
+            // A frozen color is only kept until the output has faded out
+            if (current_brightness == 0 && !temperature_ramp.active) {
+                led_ramp_cancel(&temperature_ramp);
             }
 
             effect_t *current_effect = effects[current_effect_index];
             strip_data.mode = current_effect->color_mode;
 
+            // White temperature ramps interpolate between the effect's table entries
+            bool temperature_ramping =
+                led_ramp_engaged(&temperature_ramp) && current_effect == &effect_white_temp;
+            int32_t temperature = 0;
+            if (temperature_ramping) {
+                bool ramp_running = temperature_ramp.active;
+                temperature = led_ramp_update(&temperature_ramp, now_ms);
+                if (ramp_running) {
+                    needs_render = true;
+                }
+            }
+
             bool should_run_effect = needs_render || current_effect->is_dynamic;
 
             if (should_run_effect) {
-                if (current_brightness > 0) {
+                if (output_level > 0) {
                     memset(pixel_buffer, 0, sizeof(color_t) * NUM_LEDS);
-                    if (current_effect->run) {
-                        color_t *effect_buffer = pixel_buffer + led_offset;
+                    color_t *effect_buffer = pixel_buffer + led_offset;
+                    if (temperature_ramping) {
+                        rgb_t rgb = white_temp_rgb(temperature);
+                        for (uint16_t i = 0; i < active_num_leds; i++) {
+                            effect_buffer[i].rgb = rgb;
+                        }
+                    } else if (current_effect->run) {
                         current_effect->run(current_effect->params, current_effect->num_params,
-                                          current_brightness, esp_timer_get_time() / 1000,
+                                          current_brightness, now_ms,
                                           effect_buffer, active_num_leds);
                     }
                     if (strip_data.mode == COLOR_MODE_HSV) {
                         for (uint16_t i = 0; i < NUM_LEDS; i++) {
-                            uint8_t v = (pixel_buffer[i].hsv.v * current_brightness) / 255;
-                            pixel_buffer[i].hsv.v = v;
+                            pixel_buffer[i].hsv.v = led_ramp_scale(pixel_buffer[i].hsv.v, output_level, dither);
                         }
                     } else {
                         for (uint16_t i = 0; i < NUM_LEDS; i++) {
-                            pixel_buffer[i].rgb = apply_brightness(pixel_buffer[i].rgb, current_brightness);
+                            pixel_buffer[i].rgb.r = led_ramp_scale(pixel_buffer[i].rgb.r, output_level, dither);
+                            pixel_buffer[i].rgb.g = led_ramp_scale(pixel_buffer[i].rgb.g, output_level, dither);
+                            pixel_buffer[i].rgb.b = led_ramp_scale(pixel_buffer[i].rgb.b, output_level, dither);
                         }
                     }
                 } else {
@@ -1018,6 +1282,8 @@ void led_controller_factory_reset(void) {
             effect->params[j].value = effect->params[j].default_value;
         }
     }
+    cancel_ramps();
+    led_ramp_cancel(&temperature_ramp); // Show the default temperature
 
     // Persist the factory state to NVS
     trigger_static_save();
@@ -1095,6 +1361,14 @@ effect_param_t* led_controller_get_effect_params(uint8_t *num_params) {
  */
 uint8_t led_controller_inc_brightness(int16_t steps, bool *limit_hit) {
     if (limit_hit) *limit_hit = false;
+
+    // Adjust from what is shown, not from the target of a running or held ramp
+    if (led_ramp_engaged(&brightness_ramp)) {
+        master_brightness = current_brightness > g_min_brightness ? current_brightness
+                                                                  : g_min_brightness;
+        cancel_ramps();
+    }
+
     int32_t new_brightness = (int32_t)master_brightness + steps;
 
     if (new_brightness > 255) {
@@ -1130,6 +1404,8 @@ uint8_t led_controller_inc_effect(int16_t steps) {
     }
     current_effect_index = new_index;
     current_param_index = 0; // Reset param index when changing effect
+    cancel_ramps();
+    led_ramp_cancel(&temperature_ramp); // A frozen color belongs to the old effect
     needs_render = true;
     if (render_task_handle) {
         xTaskNotifyGive(render_task_handle);
@@ -1148,6 +1424,9 @@ int16_t led_controller_inc_effect_param(int16_t steps, bool *limit_hit) {
     if (limit_hit) *limit_hit = false;
     effect_t *current_effect = effects[current_effect_index];
 
+    // A manual parameter change overrides a running or frozen temperature ramp
+    led_ramp_cancel(&temperature_ramp);
+
     if (current_effect->num_params > 0) {
         effect_param_t *param = &current_effect->params[current_param_index];
         int32_t new_value = (int32_t)param->value + (steps * param->step);
@@ -0,0 +1,107 @@
+/**
+ * @file led_ramp.c
+ * @brief Long-duration fixed-point ramp engine implementation
+ *
+ * @details Implements a linear ramp evaluated from elapsed time. The only
+ *          64-bit division happens when the ramp is started; each update is
+ *          a single multiply and shift. Also provides the dithered output
+ *          scaling that carries the ramp's fraction to 8-bit channels.
+ *
+ * @author Your Name
+ * @date 2024-03-15
+ * @version 1.0
+ */
+
+// Project specific headers
+#include "led_ramp.h"
+
+/**
+ * @brief Start a ramp
+ */
+void led_ramp_start(led_ramp_t *ramp, int32_t start, int32_t end,
+                    uint32_t duration_ms, uint64_t now_ms, bool hold) {
+    ramp->start = start;
+    ramp->end = end;
+    ramp->start_ms = now_ms;
+    ramp->duration_ms = duration_ms;
+    ramp->rate = 0;
+    ramp->active = duration_ms > 0;
+    ramp->hold = hold;
+
+    if (ramp->active) {
+        // 16.16 delta scaled by 2^32 gives a 16.48 rate per millisecond
+        ramp->rate = ((int64_t)end - start) * 4294967296LL / duration_ms;
+    }
+}
+
+/**
+ * @brief Get the ramp value at the given time
+ */
+int32_t led_ramp_update(led_ramp_t *ramp, uint64_t now_ms) {
+    if (!ramp->active) {
+        return ramp->end;
+    }
+
+    uint64_t elapsed = (now_ms > ramp->start_ms) ? now_ms - ramp->start_ms : 0;
+    if (elapsed >= ramp->duration_ms) {
+        ramp->active = false;
+        return ramp->end;
+    }
+
+    // Back from 16.48 to 16.16. Division truncates toward the start value,
+    // so the output never overshoots in either direction
+    return ramp->start + (int32_t)(ramp->rate * (int64_t)elapsed / 4294967296LL);
+}
+
+/**
+ * @brief Check whether a ramp still owns its output
+ */
+bool led_ramp_engaged(const led_ramp_t *ramp) {
+    return ramp->active || ramp->hold;
+}
+
+/**
+ * @brief Stop a ramp where it is and hold that value
+ */
+void led_ramp_freeze(led_ramp_t *ramp, uint64_t now_ms) {
+    if (!led_ramp_engaged(ramp)) {
+        return;
+    }
+
+    int32_t value = led_ramp_update(ramp, now_ms);
+    ramp->start = value;
+    ramp->end = value;
+    ramp->rate = 0;
+    ramp->active = false;
+    ramp->hold = true;
+}
+
+/**
+ * @brief Get the ordered dither offset for a frame
+ */
+uint8_t led_ramp_dither(uint8_t frame) {
+    frame = (uint8_t)((frame & 0xF0) >> 4 | (frame & 0x0F) << 4);
+    frame = (uint8_t)((frame & 0xCC) >> 2 | (frame & 0x33) << 2);
+    frame = (uint8_t)((frame & 0xAA) >> 1 | (frame & 0x55) << 1);
+
+    // Keep the reversed low bits of the counter, which land at the top
+    return (uint8_t)(frame & (0xFF << (8 - LED_RAMP_DITHER_BITS)));
+}
+
+/**
+ * @brief Scale a color channel by an 8.8 fixed-point output level
+ */
+uint8_t led_ramp_scale(uint8_t value, uint16_t level, uint8_t dither) {
+    // Scaled value with 8 fractional bits; the offset decides how often the
+    // fraction rounds up, in proportion to its size
+    uint32_t scaled = ((uint32_t)value * level) / 255 + dither;
+    return scaled > 0xFFFF ? 255 : (uint8_t)(scaled >> 8);
+}
+
+/**
+ * @brief Stop a ramp and release a held end value
+ */
+void led_ramp_cancel(led_ramp_t *ramp) {
+    ramp->active = false;
+    ramp->hold = false;
+}
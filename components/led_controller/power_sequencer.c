@@ -0,0 +1,95 @@
+/**
+ * @file power_sequencer.c
+ * @brief Power sequencing between the relay and the LED output
+ *
+ * @details Implements the OFF/ON state machine described in
+ *          power_sequencer.h. All hardware access goes through the hooks.
+ *
+ * @author Your Name
+ * @date 2024-03-15
+ * @version 1.0
+ */
+
+// Set log level for this module, must come before esp_log.h
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+// ESP-IDF system services
+#include "esp_log.h"
+
+// Project specific headers
+#include "power_sequencer.h"
+
+static const char *TAG = "POWER_SEQ";
+
+//------------------------------------------------------------------------------
+// PRIVATE FUNCTION DECLARATIONS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Send black frames until one is latched or attempts run out
+ *
+ * @param seq Sequencer instance
+ * @return true if a black frame was latched
+ */
+static bool latch_black_frame(power_seq_t *seq);
+
+//------------------------------------------------------------------------------
+// PRIVATE FUNCTION IMPLEMENTATIONS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Send black frames until one is latched or attempts run out
+ */
+static bool latch_black_frame(power_seq_t *seq) {
+    for (uint8_t attempt = 0; attempt < seq->latch_attempts; attempt++) {
+        if (seq->hooks.send_black_frame(seq->hooks.ctx)) {
+            return true;
+        }
+    }
+    ESP_LOGE(TAG, "Black frame not latched after %d attempts, continuing", seq->latch_attempts);
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// PUBLIC FUNCTION IMPLEMENTATIONS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Initialize a power sequencer in the OFF state
+ */
+void power_seq_init(power_seq_t *seq, const power_seq_hooks_t *hooks,
+                    uint32_t settle_ms, uint8_t latch_attempts) {
+    seq->hooks = *hooks;
+    seq->settle_ms = settle_ms;
+    seq->latch_attempts = latch_attempts > 0 ? latch_attempts : 1;
+    seq->state = POWER_STATE_OFF;
+}
+
+/**
+ * @brief Advance the power sequence, called once per render iteration
+ */
+power_seq_action_t power_seq_update(power_seq_t *seq, bool power_needed, bool output_black) {
+    if (seq->state == POWER_STATE_OFF) {
+        if (!power_needed) {
+            return POWER_SEQ_SUSPEND;
+        }
+
+        // Power up: the strip may show stale data until the black frame lands
+        ESP_LOGI(TAG, "Power up: relay ON, waiting %lums to settle", (unsigned long)seq->settle_ms);
+        seq->hooks.relay_on(seq->hooks.ctx);
+        seq->hooks.delay_ms(seq->hooks.ctx, seq->settle_ms);
+        latch_black_frame(seq);
+        seq->state = POWER_STATE_ON;
+        return POWER_SEQ_POWERED_UP;
+    }
+
+    if (!power_needed && output_black) {
+        // Fade-out has finished, cut power behind a latched black frame
+        ESP_LOGI(TAG, "Power down: latching black frame, relay OFF");
+        latch_black_frame(seq);
+        seq->hooks.relay_off(seq->hooks.ctx);
+        seq->state = POWER_STATE_OFF;
+        return POWER_SEQ_SUSPEND;
+    }
+
+    return POWER_SEQ_RENDER;
+}
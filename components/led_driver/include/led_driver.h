@@ -13,6 +13,7 @@
 #pragma once
 
 // System includes
+#include <stdbool.h>
 #include <stdint.h>
 
 // FreeRTOS components
@@ -44,4 +45,23 @@ void led_driver_init(QueueHandle_t input_queue);
  * 
  * @note Correction values are applied as multipliers to each color channel
  */
-void led_driver_set_correction(uint8_t r, uint8_t g, uint8_t b);
\ No newline at end of file
+void led_driver_set_correction(uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Wait until a frame sent with the sync flag has been latched.
+ *
+ * @details Blocks until the driver task has written and refreshed a
+ *          `led_strip_t` frame whose `sync` field is set. Used by the
+ *          controller to make sure a black frame is on the strip before the
+ *          relay cuts power.
+ *
+ * @param[in] timeout Maximum time to wait, in ticks
+ * @return true if a sync frame was latched, false on timeout or if the
+ *         driver has not been initialized yet. A sync frame whose pixel
+ *         write or refresh failed is never acknowledged, so it times out
+ *
+ * @note Only one task should wait on sync frames at a time
+ * @note led_driver_init() must run before the controller restores an ON
+ *       state, otherwise the power-up black frame is not acknowledged
+ */
+bool led_driver_wait_latched(TickType_t timeout);
\ No newline at end of file
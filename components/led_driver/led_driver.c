@@ -23,6 +23,7 @@
 // FreeRTOS components
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 // Project specific headers
@@ -48,6 +49,9 @@ static led_strip_handle_t led_strip_handle;
 /// @brief Queue for receiving pixel data from the controller
 static QueueHandle_t q_pixels_in = NULL;
 
+/// @brief Given after a frame with the sync flag set has been latched
+static SemaphoreHandle_t frame_latched_sem = NULL;
+
 /// @brief Global color correction values for white balance
 static uint16_t g_correction_r; ///< Red channel correction
 static uint16_t g_correction_g; ///< Green channel correction
@@ -148,6 +152,9 @@ static void led_driver_task(void *pv) {
 				continue;
 			}
 
+			// A sync frame is only acknowledged if every step succeeded
+			bool frame_ok = true;
+
 			// Loop through all pixels, apply color correction, and set them
 			for (uint16_t i = 0; i < strip_data.num_pixels; i++) {
 				rgb_t final_rgb;
@@ -175,6 +182,7 @@ static void led_driver_task(void *pv) {
 				if (err != ESP_OK) {
 					ESP_LOGE(TAG, "Failed to set pixel %d: %s", i,
 							 esp_err_to_name(err));
+					frame_ok = false;
 				}
 			}
 
@@ -183,6 +191,14 @@ static void led_driver_task(void *pv) {
 			if (err != ESP_OK) {
 				ESP_LOGE(TAG, "Failed to refresh LED strip: %s",
 						 esp_err_to_name(err));
+				frame_ok = false;
+			}
+
+			// The refresh blocks until the RMT transmission, including the
+			// trailing reset code, has completed, so the frame is latched.
+			// A failed frame is not acknowledged, the caller retries it
+			if (strip_data.sync && frame_ok) {
+				xSemaphoreGive(frame_latched_sem);
 			}
 		}
 	}
@@ -212,6 +228,12 @@ void led_driver_init(QueueHandle_t input_queue) {
 	}
 	q_pixels_in = input_queue;
 
+	frame_latched_sem = xSemaphoreCreateBinary();
+	if (frame_latched_sem == NULL) {
+		ESP_LOGE(TAG, "Failed to create frame latched semaphore");
+		return;
+	}
+
 	// Load static data to get color correction values
 	static_data_t static_data;
 	esp_err_t load_err = nvs_manager_load_static_data(&static_data);
@@ -247,4 +269,14 @@ void led_driver_init(QueueHandle_t input_queue) {
 	} else {
 		ESP_LOGI(TAG, "LED driver task created successfully");
 	}
+}
+
+/**
+ * @brief Wait until a frame sent with the sync flag has been latched
+ */
+bool led_driver_wait_latched(TickType_t timeout) {
+	if (frame_latched_sem == NULL) {
+		return false;
+	}
+	return xSemaphoreTake(frame_latched_sem, timeout) == pdTRUE;
 }
\ No newline at end of file
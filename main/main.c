@@ -189,6 +189,11 @@ void app_main(void) {
 	configASSERT(led_strip_queue != NULL);
 	ESP_LOGI(TAG, "Real LED Controller initialized.");
 
+	// Inicializa o LED Driver before restoring state: a restored ON state starts
+	// the power-up sequence, which waits on the driver to latch a black frame
+	led_driver_init(led_strip_queue);
+	ESP_LOGI(TAG, "LED Driver initialized.");
+
 	// Load data from NVS and apply it
 	ESP_LOGI(TAG, "Loading configuration from NVS...");
 	volatile_data_t v_data;
@@ -210,19 +215,13 @@ void app_main(void) {
 	led_controller_apply_nvs_data(&v_data, &s_data);
 
 	// Synchronize FSM state with loaded data
+	// The LED controller powers the relay up itself when the restored state is ON
 	if (v_data.is_on) {
 		fsm_set_initial_state(MODE_DISPLAY);
-#if RELAY_IS_USED
-		relay_controller_on();
-#endif 
 	} else {
 		fsm_set_initial_state(MODE_OFF);
 	}
 	ESP_LOGI(TAG, "NVS configuration loaded and applied.");
 
-	// Inicializa o LED Driver
-	led_driver_init(led_strip_queue);
-	ESP_LOGI(TAG, "LED Driver initialized.");
-
 	ESP_LOGI(TAG, "System initialized. Monitoring events...");
 }
@@ -121,6 +121,10 @@
 #define DEFAULT_GREEN_CORRECTION 	210
 #define DEFAULT_BLUE_CORRECTION 	180
 
+// Long-duration ramps
+#define SUNRISE_DURATION_MIN	30 // Wake-up light ramp duration in minutes
+#define SUNSET_DURATION_MIN		30 // Wind-down ramp duration in minutes
+
 
 // Default values for configurable parameters
 #define DEFAULT_MIN_BRIGHTNESS 	20 // Default minimum brightness value (0-255)
@@ -139,6 +143,9 @@
 // ==================================================
 #define RELAY_IS_USED 			0
 #define RELAY_OFF_DELAY_MS   3000           // Delay in ms to turn off the relay
+#define LED_POWER_SETTLE_MS          50     // Delay in ms after relay ON before the first (black) frame is sent
+#define LED_POWER_LATCH_TIMEOUT_MS  100     // Max wait in ms for the driver to latch a black frame
+#define LED_POWER_LATCH_ATTEMPTS      3     // Black frame attempts before switching the relay anyway
 
 // ==================================================
 // ESP-NOW Configuration